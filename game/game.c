@@ -6,6 +6,8 @@
 #include <math.h>
 #include <stdlib.h>
 
+static SolvedTable *solvedTable = NULL;
+
 // Function to check if a player has won
 int checkWin(Board *board, char player) {
     for (int i = 0; i < board->size; i++) {
@@ -308,7 +310,19 @@ double computerMoveParallelV2(Board *board, char currentMarker, int isMaximizing
     return endTime - startTime;
 }
 
+// Lets the computer skip the search in positions proven by the df-pn solver
+void setSolvedTable(SolvedTable *table) {
+    solvedTable = table;
+}
+
 double makeComputerMove(Board *board, char marker, int isMaximizing, int maxDepth, int algorithm, int numThreads) {
+    double startTime = omp_get_wtime();
+    int row, col;
+    if (findSolvedMove(solvedTable, board, marker, &row, &col)) {
+        board->cells[row][col] = marker;
+        return omp_get_wtime() - startTime;
+    }
+
     switch (algorithm) {
         case 1:
             return computerMove(board, marker, isMaximizing, maxDepth);
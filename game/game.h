@@ -2,6 +2,7 @@
 #define GENERALIZEDTICTACTOE_GAME_H
 
 #include "board.h"
+#include "solver.h"
 
 int checkWin(Board *board, char player);
 
@@ -21,6 +22,8 @@ double computerMoveParallelV1(Board *board, char currentMarker, int isMaximizing
 
 double computerMoveParallelV2(Board *board, char currentMarker, int isMaximizingPlayer, int maxDepth, int numberOfThreads);
 
+void setSolvedTable(SolvedTable *table);
+
 double makeComputerMove(Board *board, char marker, int isMaximizing, int maxDepth, int algorithm, int numThreads);
 
 void runPlayerVsComputer(Board *board, int maxDepth, int algorithm, int numThreads);
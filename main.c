@@ -1,10 +1,12 @@
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <time.h>
 #include <unistd.h>
 
 #include "board/board.h"
 #include "game/game.h"
+#include "solver/solver.h"
 
 int getIntInput(const char *prompt, int min, int max) {
     int value;
@@ -19,7 +21,31 @@ int getIntInput(const char *prompt, int min, int max) {
     }
 }
 
-void runPerformanceTest(int size, int maxDepth, int algorithm, int numThreads, int gameMode, int debugMode) {
+int selectNumThreads() {
+    printf("\nSelect Number of Threads:\n");
+    printf(" (1) 2 Threads\n");
+    printf(" (2) 4 Threads\n");
+    printf(" (3) 8 Threads\n");
+    int threadChoice = getIntInput("Choice [1-3]: ", 1, 3);
+    switch (threadChoice) {
+        case 1: return 2;
+        case 2: return 4;
+        default: return 8;
+    }
+}
+
+void runPerformanceTest(int size, int maxDepth, int algorithm, int numThreads, int gameMode, int debugMode, const char *solvedFile) {
+    // stdout is the CSV stream, so a table that cannot be used is reported on stderr
+    SolvedTable solvedTable;
+    if (solvedFile != NULL) {
+        if (!loadSolvedTable(&solvedTable, solvedFile) || solvedTable.size != size) {
+            fprintf(stderr, "Error: could not load solved positions for a %dx%d board from %s.\n", size, size, solvedFile);
+            freeSolvedTable(&solvedTable);
+            exit(1);
+        }
+        setSolvedTable(&solvedTable);
+    }
+
     Board board = createBoard(size);
     initializeBoard(&board);
 
@@ -35,18 +61,113 @@ void runPerformanceTest(int size, int maxDepth, int algorithm, int numThreads, i
     }
 
     freeBoard(&board);
+    if (solvedFile != NULL) {
+        setSolvedTable(NULL);
+        freeSolvedTable(&solvedTable);
+    }
+}
+
+// Fills the board from a row-major string of 'X', 'O' and '.'; returns 0 if it is not a reachable position
+int parsePosition(Board *board, const char *position) {
+    int xCount = 0, oCount = 0;
+    if ((int)strlen(position) != board->size * board->size) return 0;
+
+    for (int k = 0; position[k] != '\0'; k++) {
+        char cell = position[k];
+        if (cell == 'X') xCount++;
+        else if (cell == 'O') oCount++;
+        else if (cell != '.') return 0;
+        board->cells[k / board->size][k % board->size] = cell == '.' ? ' ' : cell;
+    }
+
+    // X moves first, and a line can only belong to the player who made the last move
+    if (xCount != oCount && xCount != oCount + 1) return 0;
+    if (checkWin(board, 'X') && xCount != oCount + 1) return 0;
+    if (checkWin(board, 'O') && xCount != oCount) return 0;
+    return 1;
+}
+
+void readPosition(int size, char *position) {
+    Board board = createBoard(size);
+    while (1) {
+        printf("Enter the position row by row using X, O and . (%d characters): ", size * size);
+        if (scanf("%81s", position) == 1 && parsePosition(&board, position)) {
+            while (getchar() != '\n');
+            break;
+        }
+        printf("Invalid position. X moves first and the position must be reachable.\n");
+        while (getchar() != '\n');
+    }
+    freeBoard(&board);
+}
+
+// Proves the value of a position (the empty board if none is given) with df-pn and optionally exports
+// the proven positions; returns 0 on success
+int runSolver(int size, int numThreads, int tableMegabytes, long long maxNodes, const char *position, const char *exportFile) {
+    Board board = createBoard(size);
+    initializeBoard(&board);
+    if (position != NULL && !parsePosition(&board, position)) {
+        printf("Error: the position must have %d cells of X, O or . and be reachable with X moving first.\n", size * size);
+        freeBoard(&board);
+        return 1;
+    }
+
+    DfpnSolver solver = createSolver(size, tableMegabytes, numThreads);
+    if (solver.table == NULL) {
+        freeSolver(&solver);
+        freeBoard(&board);
+        return 1;
+    }
+
+    printf("\nSolving a %dx%d position. Threads: %d. Table: %d MB.\n", size, size, numThreads, tableMegabytes);
+    printBoard(&board);
+    DfpnValue value = solvePosition(&solver, &board, maxNodes, 1000000);
+    printf("\n");
+    printSolvedValue(value);
+
+    if (exportFile != NULL) {
+        exportSolvedPositions(&solver, exportFile);
+    }
+
+    freeBoard(&board);
+    freeSolver(&solver);
+    return 0;
 }
 
 void runInteractiveMode() {
 
     int size = getIntInput("Enter the size of the board (N) [3-9]: ", 3, 9);
 
-    int maxDepth = getIntInput("Enter max depth [4-10]: ", 4, 10);
-
     printf("\nSelect Game Mode:\n");
     printf(" (1) Player vs. Computer\n");
     printf(" (2) Computer vs. Computer\n");
-    int gameMode = getIntInput("Choice [1-2]: ", 1, 2);
+    printf(" (3) Solve the board (df-pn)\n");
+    int gameMode = getIntInput("Choice [1-3]: ", 1, 3);
+
+    char solvedFile[32];
+    snprintf(solvedFile, sizeof(solvedFile), "solved_%d.dfpn", size);
+
+    if (gameMode == 3) {
+        int numThreads = 1;
+        if (getIntInput("\nRun the solver in parallel? (0) No (1) Yes: ", 0, 1)) {
+            numThreads = selectNumThreads();
+        }
+        int tableMegabytes = getIntInput("Hash table size in MB [16-4096]: ", 16, 4096);
+        int maxMillionNodes = getIntInput("Node limit in millions (0 = no limit) [0-100000]: ", 0, 100000);
+        int exportResults = getIntInput("Export proven positions? (0) No (1) Yes: ", 0, 1);
+
+        char position[82];
+        int givenPosition = getIntInput("Solve (1) the empty board or (2) a given position: ", 1, 2) == 2;
+        if (givenPosition) {
+            readPosition(size, position);
+        }
+
+        runSolver(size, numThreads, tableMegabytes, maxMillionNodes * 1000000LL,
+                  givenPosition ? position : NULL, exportResults ? solvedFile : NULL);
+        return;
+    }
+
+    int maxDepth = getIntInput("Enter max depth [4-10]: ", 4, 10);
 
     printf("\nSelect Algorithm:\n");
     printf(" (1) Serial (1 Thread)\n");
@@ -56,16 +177,7 @@ void runInteractiveMode() {
 
     int numThreads = 1;
     if (algorithm > 1) {
-        printf("\nSelect Number of Threads:\n");
-        printf(" (1) 2 Threads\n");
-        printf(" (2) 4 Threads\n");
-        printf(" (3) 8 Threads\n");
-        int threadChoice = getIntInput("Choice [1-3]: ", 1, 3);
-        switch (threadChoice) {
-            case 1: numThreads = 2; break;
-            case 2: numThreads = 4; break;
-            case 3: numThreads = 8; break;
-        }
+        numThreads = selectNumThreads();
     }
     printf("Using %d thread(s).\n", numThreads);
 
@@ -78,6 +190,19 @@ void runInteractiveMode() {
         debugMode = debugMode == 1;
     }
 
+    // Positions exported by the solver let the computer play them without searching
+    SolvedTable solvedTable;
+    int useSolvedTable = 0;
+    if (loadSolvedTable(&solvedTable, solvedFile)) {
+        printf("\nFound %d proven positions in %s.\n", solvedTable.count, solvedFile);
+        useSolvedTable = getIntInput("Use them to skip the search? (0) No (1) Yes: ", 0, 1);
+        if (useSolvedTable) {
+            setSolvedTable(&solvedTable);
+        } else {
+            freeSolvedTable(&solvedTable);
+        }
+    }
+
     Board board = createBoard(size);
     initializeBoard(&board);
     printf("\nStarting %dx%d game. Max Depth: %d. Algorithm: %d. Threads: %d.\n",
@@ -96,6 +221,10 @@ void runInteractiveMode() {
     }
 
     freeBoard(&board);
+    if (useSolvedTable) {
+        setSolvedTable(NULL);
+        freeSolvedTable(&solvedTable);
+    }
 }
 
 
@@ -103,8 +232,27 @@ void runInteractiveMode() {
 int main(int argc, char *argv[]) {
     srand(time(NULL)); // Seed the random number generator
 
-    if (argc == 7) {
-        // ./GeneralizedTicTacToe <N> <Depth> <Algorithm> <Threads> <GameMode> <DebugMode>
+    if (argc >= 6 && strcmp(argv[1], "solve") == 0) {
+        // ./GeneralizedTicTacToe solve <N> <Threads> <TableMB> <MaxNodes> [ExportFile|-] [Position]
+        // Position is row-major, e.g. "X...O...." for a 3x3 board; "-" skips the export
+        int size           = atoi(argv[2]);
+        int numThreads     = atoi(argv[3]);
+        int tableMegabytes = atoi(argv[4]);
+        long long maxNodes = atoll(argv[5]);
+
+        if (argc > 8) {
+            printf("Usage: %s solve <N> <Threads> <TableMB> <MaxNodes> [ExportFile|-] [Position]\n", argv[0]);
+            return 1;
+        }
+        if (size < 3 || size > 9 || numThreads < 1 || tableMegabytes < 1 || maxNodes < 0) {
+            printf("Error: expected N in [3-9], Threads >= 1, TableMB >= 1 and MaxNodes >= 0.\n");
+            return 1;
+        }
+
+        const char *exportFile = argc >= 7 && strcmp(argv[6], "-") != 0 ? argv[6] : NULL;
+        return runSolver(size, numThreads, tableMegabytes, maxNodes, argc >= 8 ? argv[7] : NULL, exportFile);
+    } else if (argc == 7 || argc == 8) {
+        // ./GeneralizedTicTacToe <N> <Depth> <Algorithm> <Threads> <GameMode> <DebugMode> [SolvedFile]
         int size       = atoi(argv[1]);
         int maxDepth   = atoi(argv[2]);
         int algorithm  = atoi(argv[3]);
@@ -112,7 +260,7 @@ int main(int argc, char *argv[]) {
         int gameMode   = atoi(argv[5]);
         int debugMode  = atoi(argv[6]);
 
-        runPerformanceTest(size, maxDepth, algorithm, numThreads, gameMode, debugMode);
+        runPerformanceTest(size, maxDepth, algorithm, numThreads, gameMode, debugMode, argc == 8 ? argv[7] : NULL);
     } else {
         runInteractiveMode();
     }
@@ -0,0 +1,781 @@
+#include "solver.h"
+#include "game.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define DFPN_INF 100000000u
+#define DFPN_MAX_CELLS 81
+#define DFPN_BUCKET_SIZE 4
+#define DFPN_LOCKS 4096
+#define DFPN_FLUSH_INTERVAL 1024
+#define DFPN_ATTACKER_O_KEY 0x9e3779b97f4a7c15ULL
+
+static unsigned long long zobristKeys[DFPN_MAX_CELLS][2];
+static int zobristReady = 0;
+
+// Per-thread search state, every thread works on its own copy of the board
+typedef struct {
+    DfpnSolver *solver;
+    Board board;
+    unsigned long long key;
+    unsigned long long rootKey;
+    char attacker;
+    int id;
+    long long nodes;
+    long long pendingNodes;
+} DfpnWorker;
+
+// SplitMix64 with a fixed seed, so exported keys stay valid between runs
+static void initZobristKeys(void) {
+    if (zobristReady) return;
+    unsigned long long state = 0x243f6a8885a308d3ULL;
+    for (int i = 0; i < DFPN_MAX_CELLS; i++) {
+        for (int j = 0; j < 2; j++) {
+            state += 0x9e3779b97f4a7c15ULL;
+            unsigned long long z = state;
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+            zobristKeys[i][j] = z ^ (z >> 31);
+        }
+    }
+    zobristReady = 1;
+}
+
+static unsigned long long cellKey(int size, int row, int column, char marker) {
+    return zobristKeys[row * size + column][marker == 'O'];
+}
+
+static unsigned long long hashBoard(Board *board) {
+    unsigned long long key = 0;
+    for (int i = 0; i < board->size; i++) {
+        for (int j = 0; j < board->size; j++) {
+            if (board->cells[i][j] != ' ') key ^= cellKey(board->size, i, j, board->cells[i][j]);
+        }
+    }
+    return key;
+}
+
+// Both proofs of a position share the table, so the attacker is part of the key
+static unsigned long long attackerKey(char attacker) {
+    return attacker == 'O' ? DFPN_ATTACKER_O_KEY : 0;
+}
+
+static char opponentOf(char marker) {
+    return marker == 'X' ? 'O' : 'X';
+}
+
+// X always moves first, so the side to move follows from the piece count
+static char sideToMove(Board *board) {
+    int xCount = 0, oCount = 0;
+    for (int i = 0; i < board->size; i++) {
+        for (int j = 0; j < board->size; j++) {
+            if (board->cells[i][j] == 'X') xCount++;
+            else if (board->cells[i][j] == 'O') oCount++;
+        }
+    }
+    return xCount > oCount ? 'O' : 'X';
+}
+
+static unsigned int addSaturated(unsigned int a, unsigned int b) {
+    return a >= DFPN_INF - b ? DFPN_INF : a + b;
+}
+
+static void printProofNumber(unsigned int value) {
+    if (value >= DFPN_INF) {
+        printf("inf");
+    } else {
+        printf("%u", value);
+    }
+}
+
+static size_t bucketIndex(DfpnSolver *solver, unsigned long long key) {
+    return (size_t)(key ^ (key >> 32)) & (solver->tableBuckets - 1);
+}
+
+static int lookupEntry(DfpnSolver *solver, unsigned long long key, DfpnEntry *result) {
+    size_t bucket = bucketIndex(solver, key);
+    DfpnEntry *entries = &solver->table[bucket * DFPN_BUCKET_SIZE];
+    int found = 0;
+
+    omp_set_lock(&solver->locks[bucket & (DFPN_LOCKS - 1)]);
+    for (int i = 0; i < DFPN_BUCKET_SIZE; i++) {
+        if (entries[i].work > 0 && entries[i].key == key) {
+            *result = entries[i];
+            found = 1;
+            break;
+        }
+    }
+    omp_unset_lock(&solver->locks[bucket & (DFPN_LOCKS - 1)]);
+    return found;
+}
+
+// When the bucket is full the entry that took the least work to compute is replaced, preferring
+// entries no thread is searching; busyChange counts threads entering (+1) or leaving (-1) the node
+static void storeEntry(DfpnSolver *solver, unsigned long long key, char attacker, char toMove,
+                       unsigned int pn, unsigned int dn, long long work, int busyChange) {
+    size_t bucket = bucketIndex(solver, key);
+    DfpnEntry *entries = &solver->table[bucket * DFPN_BUCKET_SIZE];
+    unsigned int clampedWork = work > DFPN_INF ? DFPN_INF : (work < 1 ? 1 : (unsigned int)work);
+
+    omp_set_lock(&solver->locks[bucket & (DFPN_LOCKS - 1)]);
+    DfpnEntry *slot = NULL;
+    for (int i = 0; i < DFPN_BUCKET_SIZE; i++) {
+        if (entries[i].work > 0 && entries[i].key == key) {
+            slot = &entries[i];
+            break;
+        }
+    }
+    if (slot == NULL) {
+        slot = &entries[0];
+        for (int i = 1; i < DFPN_BUCKET_SIZE; i++) {
+            if ((entries[i].busy == 0) != (slot->busy == 0)) {
+                if (entries[i].busy == 0) slot = &entries[i];
+            } else if (entries[i].work < slot->work) {
+                slot = &entries[i];
+            }
+        }
+        slot->key = key;
+        slot->work = 0;
+        slot->mark = 0;
+        slot->attacker = attacker;
+        slot->toMove = toMove;
+        slot->busy = 0;
+    }
+    slot->pn = pn;
+    slot->dn = dn;
+    if (busyChange > 0) slot->busy++;
+    else if (busyChange < 0 && slot->busy > 0) slot->busy--;
+    if (clampedWork > slot->work) slot->work = clampedWork;
+    omp_unset_lock(&solver->locks[bucket & (DFPN_LOCKS - 1)]);
+}
+
+static void markEntry(DfpnSolver *solver, unsigned long long key) {
+    size_t bucket = bucketIndex(solver, key);
+    DfpnEntry *entries = &solver->table[bucket * DFPN_BUCKET_SIZE];
+
+    omp_set_lock(&solver->locks[bucket & (DFPN_LOCKS - 1)]);
+    for (int i = 0; i < DFPN_BUCKET_SIZE; i++) {
+        if (entries[i].work > 0 && entries[i].key == key) {
+            entries[i].mark = solver->epoch;
+            break;
+        }
+    }
+    omp_unset_lock(&solver->locks[bucket & (DFPN_LOCKS - 1)]);
+}
+
+// Sets pn/dn if the game is over; only the previous mover can have completed a line
+static int terminalValue(Board *board, char toMove, char attacker, unsigned int *pn, unsigned int *dn) {
+    char lastMover = opponentOf(toMove);
+    if (checkWin(board, lastMover)) {
+        *pn = lastMover == attacker ? 0 : DFPN_INF;
+        *dn = lastMover == attacker ? DFPN_INF : 0;
+        return 1;
+    }
+    if (isBoardFull(board)) {
+        *pn = DFPN_INF;
+        *dn = 0;
+        return 1;
+    }
+    return 0;
+}
+
+// A new move can only complete the lines through its own cell, so only those are checked
+static int completesLine(Board *board, int row, int column, char marker) {
+    int size = board->size;
+    int rowWin = 1, colWin = 1;
+    int diag1Win = row == column, diag2Win = row + column == size - 1;
+    for (int k = 0; k < size; k++) {
+        if (board->cells[row][k] != marker) rowWin = 0;
+        if (board->cells[k][column] != marker) colWin = 0;
+        if (board->cells[k][k] != marker) diag1Win = 0;
+        if (board->cells[k][size - 1 - k] != marker) diag2Win = 0;
+    }
+    return rowWin || colWin || diag1Win || diag2Win;
+}
+
+// phi/delta are the proof numbers seen from the side to move: (pn, dn) at OR nodes, (dn, pn) at AND nodes
+static void toPhiDelta(char toMove, char attacker, unsigned int pn, unsigned int dn, unsigned int *phi, unsigned int *delta) {
+    if (toMove == attacker) {
+        *phi = pn;
+        *delta = dn;
+    } else {
+        *phi = dn;
+        *delta = pn;
+    }
+}
+
+static int stopRequested(DfpnSolver *solver) {
+    int stop;
+    #pragma omp atomic read
+    stop = solver->stop;
+    return stop;
+}
+
+static void reportProgress(DfpnWorker *worker, long long totalNodes) {
+    DfpnEntry root;
+    unsigned int pn = 1, dn = 1;
+    if (lookupEntry(worker->solver, worker->rootKey, &root)) {
+        pn = root.pn;
+        dn = root.dn;
+    }
+    printf("[df-pn] nodes: %lld, root pn: ", totalNodes);
+    printProofNumber(pn);
+    printf(", root dn: ");
+    printProofNumber(dn);
+    printf("\n");
+    fflush(stdout);
+}
+
+// Node counts are batched per thread to keep the shared counter off the hot path
+static void flushNodes(DfpnWorker *worker) {
+    DfpnSolver *solver = worker->solver;
+    long long totalNodes;
+
+    #pragma omp atomic capture
+    totalNodes = solver->nodes += worker->pendingNodes;
+    worker->pendingNodes = 0;
+
+    if (solver->maxNodes > 0 && totalNodes >= solver->maxNodes) {
+        #pragma omp atomic write
+        solver->stop = 1;
+    }
+
+    // Only thread 0 reports, so nextReport needs no synchronization
+    if (worker->id == 0 && solver->progressInterval > 0 && totalNodes >= solver->nextReport) {
+        reportProgress(worker, totalNodes);
+        solver->nextReport = totalNodes + solver->progressInterval;
+    }
+}
+
+static void countNode(DfpnWorker *worker) {
+    worker->nodes++;
+    if (++worker->pendingNodes >= DFPN_FLUSH_INTERVAL) flushNodes(worker);
+}
+
+// Nagai's multiple iterative deepening: expand the most proving child until a threshold is exceeded
+static void dfpnSearch(DfpnWorker *worker, unsigned int thresholdPhi, unsigned int thresholdDelta, char toMove) {
+    DfpnSolver *solver = worker->solver;
+    Board *board = &worker->board;
+    char attacker = worker->attacker;
+    char childToMove = opponentOf(toMove);
+    long long startNodes = worker->nodes;
+    unsigned int pn = 1, dn = 1, phi, delta;
+    DfpnEntry entry;
+
+    countNode(worker);
+
+    if (lookupEntry(solver, worker->key, &entry)) {
+        pn = entry.pn;
+        dn = entry.dn;
+    } else if (terminalValue(board, toMove, attacker, &pn, &dn)) {
+        storeEntry(solver, worker->key, attacker, toMove, pn, dn, 1, 0);
+        return;
+    }
+
+    toPhiDelta(toMove, attacker, pn, dn, &phi, &delta);
+    if (phi >= thresholdPhi || delta >= thresholdDelta) return;
+
+    storeEntry(solver, worker->key, attacker, toMove, pn, dn, 1, 1);
+
+    int moves[DFPN_MAX_CELLS];
+    unsigned long long childKeys[DFPN_MAX_CELLS];
+    int totalMoves = 0;
+
+    for (int i = 0; i < board->size; i++) {
+        for (int j = 0; j < board->size; j++) {
+            if (board->cells[i][j] != ' ') continue;
+            moves[totalMoves] = i * board->size + j;
+            childKeys[totalMoves] = worker->key ^ cellKey(board->size, i, j, toMove);
+            totalMoves++;
+        }
+    }
+
+    // Finished games are stored right away so an immediate win is found before any expansion;
+    // the board is full exactly when the last empty cell is played
+    for (int k = 0; k < totalMoves; k++) {
+        if (lookupEntry(solver, childKeys[k], &entry)) continue;
+
+        int row = moves[k] / board->size;
+        int column = moves[k] % board->size;
+        board->cells[row][column] = toMove;
+        if (completesLine(board, row, column, toMove)) {
+            storeEntry(solver, childKeys[k], attacker, childToMove,
+                       toMove == attacker ? 0 : DFPN_INF, toMove == attacker ? DFPN_INF : 0, 1, 0);
+        } else if (totalMoves == 1) {
+            storeEntry(solver, childKeys[k], attacker, childToMove, DFPN_INF, 0, 1, 0);
+        }
+        board->cells[row][column] = ' ';
+    }
+
+    while (1) {
+        unsigned int childPhis[DFPN_MAX_CELLS], childDeltas[DFPN_MAX_CELLS], effectiveDeltas[DFPN_MAX_CELLS];
+        phi = DFPN_INF;
+        delta = 0;
+
+        for (int k = 0; k < totalMoves; k++) {
+            unsigned int childPn = 1, childDn = 1, busy = 0;
+            if (lookupEntry(solver, childKeys[k], &entry)) {
+                childPn = entry.pn;
+                childDn = entry.dn;
+                busy = entry.busy;
+            }
+            toPhiDelta(childToMove, attacker, childPn, childDn, &childPhis[k], &childDeltas[k]);
+
+            delta = addSaturated(delta, childPhis[k]);
+            if (childDeltas[k] < phi) phi = childDeltas[k];
+
+            // Virtual loss: a child other threads are inside looks proportionally less promising
+            effectiveDeltas[k] = childDeltas[k] >= DFPN_INF / (busy + 1) ? DFPN_INF : childDeltas[k] * (busy + 1);
+        }
+
+        if (phi >= thresholdPhi || delta >= thresholdDelta || stopRequested(solver)) break;
+
+        // Only children below the threshold are eligible, so the chosen one cannot return without expanding;
+        // threads also start the scan at different children, so ties send them down different branches
+        int best = -1;
+        for (int n = 0; n < totalMoves; n++) {
+            int k = (n + worker->id) % totalMoves;
+            if (childDeltas[k] >= thresholdPhi) continue;
+            if (best == -1 || effectiveDeltas[k] < effectiveDeltas[best]) best = k;
+        }
+        unsigned int secondDelta = DFPN_INF;
+        for (int k = 0; k < totalMoves; k++) {
+            if (k != best && effectiveDeltas[k] < secondDelta) secondDelta = effectiveDeltas[k];
+        }
+        unsigned int bestChildPhi = childPhis[best];
+
+        // The root is otherwise only stored once solved, which would hide it from the progress report
+        if (worker->key == worker->rootKey) {
+            storeEntry(solver, worker->key, attacker, toMove, toMove == attacker ? phi : delta,
+                       toMove == attacker ? delta : phi, worker->nodes - startNodes, 0);
+        }
+
+        unsigned int childThresholdPhi = thresholdDelta >= DFPN_INF ? DFPN_INF : thresholdDelta - delta + bestChildPhi;
+        unsigned int childThresholdDelta = addSaturated(secondDelta, 1);
+        if (thresholdPhi < childThresholdDelta) childThresholdDelta = thresholdPhi;
+
+        int row = moves[best] / board->size;
+        int column = moves[best] % board->size;
+        board->cells[row][column] = toMove;
+        worker->key = childKeys[best];
+
+        dfpnSearch(worker, childThresholdPhi, childThresholdDelta, childToMove);
+
+        worker->key ^= cellKey(board->size, row, column, toMove);
+        board->cells[row][column] = ' ';
+    }
+
+    if (toMove == attacker) {
+        pn = phi;
+        dn = delta;
+    } else {
+        pn = delta;
+        dn = phi;
+    }
+    storeEntry(solver, worker->key, attacker, toMove, pn, dn, worker->nodes - startNodes, -1);
+}
+
+// All threads search from the root and cooperate through the shared table
+static void runWorker(DfpnSolver *solver, Board *board, char attacker, char toMove, unsigned long long rootKey) {
+    DfpnWorker worker;
+    DfpnEntry root;
+
+    worker.solver = solver;
+    worker.board = copyBoard(board);
+    worker.key = rootKey;
+    worker.rootKey = rootKey;
+    worker.attacker = attacker;
+    worker.id = omp_get_thread_num();
+    worker.nodes = 0;
+    worker.pendingNodes = 0;
+
+    while (!stopRequested(solver)) {
+        dfpnSearch(&worker, DFPN_INF, DFPN_INF, toMove);
+        if (lookupEntry(solver, rootKey, &root) && (root.pn == 0 || root.dn == 0)) {
+            #pragma omp atomic write
+            solver->stop = 1;
+        }
+    }
+
+    flushNodes(&worker);
+    freeBoard(&worker.board);
+}
+
+// Counts the distinct positions of the stored proof (or disproof) tree
+static long long proofTreeSize(DfpnSolver *solver, Board *board, unsigned long long key, char toMove, char attacker, long long *missing) {
+    DfpnEntry entry;
+    unsigned int pn, dn;
+
+    if (!lookupEntry(solver, key, &entry) || (entry.pn != 0 && entry.dn != 0)) {
+        (*missing)++;
+        return 0;
+    }
+    if (entry.mark == solver->epoch) return 0;
+    markEntry(solver, key);
+
+    if (terminalValue(board, toMove, attacker, &pn, &dn)) return 1;
+
+    // A proven OR node or a disproven AND node needs one child, every other node needs all of them
+    int proven = entry.pn == 0;
+    int singleChild = (toMove == attacker) == proven;
+    char childToMove = opponentOf(toMove);
+    long long size = 1;
+
+    for (int i = 0; i < board->size; i++) {
+        for (int j = 0; j < board->size; j++) {
+            if (board->cells[i][j] != ' ') continue;
+
+            unsigned long long childKey = key ^ cellKey(board->size, i, j, toMove);
+            if (singleChild) {
+                if (!lookupEntry(solver, childKey, &entry)) continue;
+                if ((proven ? entry.pn : entry.dn) != 0) continue;
+            }
+
+            board->cells[i][j] = toMove;
+            size += proofTreeSize(solver, board, childKey, childToMove, attacker, missing);
+            board->cells[i][j] = ' ';
+
+            if (singleChild) return size;
+        }
+    }
+
+    if (singleChild) (*missing)++;
+    return size;
+}
+
+// Runs one df-pn proof; returns 1 if the attacker wins, 0 if disproven and -1 if the search was stopped
+static int proveAttacker(DfpnSolver *solver, Board *board, char attacker, long long maxNodes, long long progressInterval) {
+    char toMove = sideToMove(board);
+    unsigned long long rootKey = hashBoard(board) ^ attackerKey(attacker);
+    double startTime = omp_get_wtime();
+    DfpnEntry root;
+    int result = -1;
+
+    solver->nodes = 0;
+    solver->maxNodes = maxNodes;
+    solver->progressInterval = progressInterval;
+    solver->nextReport = progressInterval;
+    solver->stop = 0;
+
+    printf("\nProving a win for '%c' with %d thread(s)...\n", attacker, solver->numThreads);
+
+    #pragma omp parallel num_threads(solver->numThreads) default(none) shared(solver, board, attacker, toMove, rootKey)
+    runWorker(solver, board, attacker, toMove, rootKey);
+
+    if (lookupEntry(solver, rootKey, &root)) {
+        if (root.pn == 0) result = 1;
+        else if (root.dn == 0) result = 0;
+    }
+
+    double endTime = omp_get_wtime();
+    if (result == 1) {
+        printf("'%c' wins", attacker);
+    } else if (result == 0) {
+        printf("'%c' cannot force a win", attacker);
+    } else {
+        printf("Unresolved for '%c' (node limit reached)", attacker);
+    }
+    printf(" after %lld nodes in %.4f seconds.\n", solver->nodes, endTime - startTime);
+
+    if (result != -1) {
+        long long missing = 0;
+        Board walkBoard = copyBoard(board);
+        solver->epoch++;
+        long long treeSize = proofTreeSize(solver, &walkBoard, rootKey, toMove, attacker, &missing);
+        freeBoard(&walkBoard);
+        printf("%s tree size: %lld positions", result == 1 ? "Proof" : "Disproof", treeSize);
+        if (missing > 0) printf(" (%lld evicted from the table)", missing);
+        printf(".\n");
+    }
+
+    return result;
+}
+
+// Constructor-like function; the table is rounded down to a power of two number of buckets.
+// On invalid arguments the table is left NULL and solvePosition refuses to run.
+DfpnSolver createSolver(int size, int tableMegabytes, int numThreads) {
+    DfpnSolver solver;
+    size_t maxEntries = (size_t)tableMegabytes * 1024 * 1024 / sizeof(DfpnEntry);
+
+    initZobristKeys();
+
+    solver.size = size;
+    solver.numThreads = numThreads;
+    solver.table = NULL;
+    solver.locks = NULL;
+    solver.tableBuckets = 0;
+    solver.nodes = 0;
+    solver.maxNodes = 0;
+    solver.progressInterval = 0;
+    solver.nextReport = 0;
+    solver.stop = 0;
+    solver.epoch = 0;
+
+    if (size < 1 || size * size > DFPN_MAX_CELLS) {
+        printf("Error: the solver supports boards of at most %d cells.\n", DFPN_MAX_CELLS);
+        return solver;
+    }
+    if (tableMegabytes < 1 || numThreads < 1) {
+        printf("Error: the solver needs at least 1 MB of table and 1 thread.\n");
+        return solver;
+    }
+
+    solver.tableBuckets = 1;
+    while (solver.tableBuckets * 2 * DFPN_BUCKET_SIZE <= maxEntries) solver.tableBuckets *= 2;
+    solver.table = (DfpnEntry *)calloc(solver.tableBuckets * DFPN_BUCKET_SIZE, sizeof(DfpnEntry));
+    solver.locks = (omp_lock_t *)malloc(DFPN_LOCKS * sizeof(omp_lock_t));
+    if (solver.table == NULL || solver.locks == NULL) {
+        printf("Error: could not allocate a %d MB table.\n", tableMegabytes);
+        free(solver.table);
+        free(solver.locks);
+        solver.table = NULL;
+        solver.locks = NULL;
+        solver.tableBuckets = 0;
+        return solver;
+    }
+    for (int i = 0; i < DFPN_LOCKS; i++) {
+        omp_init_lock(&solver.locks[i]);
+    }
+
+    return solver;
+}
+
+void freeSolver(DfpnSolver *solver) {
+    if (solver->locks == NULL) return;
+    for (int i = 0; i < DFPN_LOCKS; i++) {
+        omp_destroy_lock(&solver->locks[i]);
+    }
+    free(solver->locks);
+    free(solver->table);
+}
+
+// Proves the exact value: first whether the side to move wins, then whether the opponent does
+DfpnValue solvePosition(DfpnSolver *solver, Board *board, long long maxNodes, long long progressInterval) {
+    if (solver->table == NULL || board->size * board->size > DFPN_MAX_CELLS) {
+        printf("Error: the solver supports boards of at most %d cells.\n", DFPN_MAX_CELLS);
+        return DFPN_UNKNOWN;
+    }
+    if (board->size != solver->size) {
+        printf("Error: the solver was created for a %dx%d board.\n", solver->size, solver->size);
+        return DFPN_UNKNOWN;
+    }
+
+    char toMove = sideToMove(board);
+    int moverWins = proveAttacker(solver, board, toMove, maxNodes, progressInterval);
+    if (moverWins == 1) return DFPN_WIN;
+
+    int opponentWins = proveAttacker(solver, board, opponentOf(toMove), maxNodes, progressInterval);
+    if (opponentWins == 1) return DFPN_LOSS;
+    if (moverWins == 0 && opponentWins == 0) return DFPN_DRAW;
+    if (moverWins == 0) return DFPN_NOT_WIN;
+    if (opponentWins == 0) return DFPN_NOT_LOSS;
+    return DFPN_UNKNOWN;
+}
+
+static char solvedValueCode(DfpnValue value) {
+    switch (value) {
+        case DFPN_WIN: return 'W';
+        case DFPN_LOSS: return 'L';
+        case DFPN_DRAW: return 'D';
+        case DFPN_NOT_WIN: return 'N';
+        case DFPN_NOT_LOSS: return 'S';
+        default: return 0;
+    }
+}
+
+static DfpnValue solvedValueFromCode(char code) {
+    switch (code) {
+        case 'W': return DFPN_WIN;
+        case 'L': return DFPN_LOSS;
+        case 'D': return DFPN_DRAW;
+        case 'N': return DFPN_NOT_WIN;
+        case 'S': return DFPN_NOT_LOSS;
+        default: return DFPN_UNKNOWN;
+    }
+}
+
+// Combines the mover's and the opponent's proof of the same position
+static DfpnValue combineProofs(DfpnEntry *mover, DfpnEntry *opponent) {
+    int moverWins = mover != NULL && mover->pn == 0;
+    int moverFails = mover != NULL && mover->dn == 0;
+    int opponentWins = opponent != NULL && opponent->pn == 0;
+    int opponentFails = opponent != NULL && opponent->dn == 0;
+
+    if (moverWins) return DFPN_WIN;
+    if (opponentWins) return DFPN_LOSS;
+    if (moverFails && opponentFails) return DFPN_DRAW;
+    if (moverFails) return DFPN_NOT_WIN;
+    if (opponentFails) return DFPN_NOT_LOSS;
+    return DFPN_UNKNOWN;
+}
+
+// Writes every stored position with a (partially) proven value as "<key> <W|L|D|N|S>", seen from the side to move
+int exportSolvedPositions(DfpnSolver *solver, const char *fileName) {
+    FILE *file = fopen(fileName, "w");
+    if (file == NULL) {
+        printf("Error: could not open %s for writing.\n", fileName);
+        return -1;
+    }
+
+    fprintf(file, "DFPN %d\n", solver->size);
+    int count = 0;
+    for (size_t i = 0; i < solver->tableBuckets * DFPN_BUCKET_SIZE; i++) {
+        DfpnEntry *entry = &solver->table[i];
+        if (entry->work == 0) continue;
+
+        unsigned long long boardKey = entry->key ^ attackerKey(entry->attacker);
+        DfpnEntry sibling;
+        int hasSibling = lookupEntry(solver, boardKey ^ attackerKey(opponentOf(entry->attacker)), &sibling);
+        DfpnValue value;
+
+        // Each position is written once, from the mover's entry whenever that one is stored
+        if (entry->attacker == entry->toMove) {
+            value = combineProofs(entry, hasSibling ? &sibling : NULL);
+        } else if (!hasSibling) {
+            value = combineProofs(NULL, entry);
+        } else {
+            continue;
+        }
+
+        if (value != DFPN_UNKNOWN) {
+            fprintf(file, "%016llx %c\n", boardKey, solvedValueCode(value));
+            count++;
+        }
+    }
+
+    fclose(file);
+    printf("Exported %d solved positions to %s.\n", count, fileName);
+    return count;
+}
+
+static int compareSolvedPositions(const void *a, const void *b) {
+    unsigned long long keyA = ((const SolvedPosition *)a)->key;
+    unsigned long long keyB = ((const SolvedPosition *)b)->key;
+    return (keyA > keyB) - (keyA < keyB);
+}
+
+// Returns 1 if the whole file was read, 0 if it is missing, malformed or could not be held in memory
+int loadSolvedTable(SolvedTable *table, const char *fileName) {
+    table->size = 0;
+    table->count = 0;
+    table->positions = NULL;
+
+    FILE *file = fopen(fileName, "r");
+    if (file == NULL) return 0;
+    if (fscanf(file, "DFPN %d", &table->size) != 1 || table->size < 1 || table->size * table->size > DFPN_MAX_CELLS) {
+        table->size = 0;
+        fclose(file);
+        return 0;
+    }
+
+    initZobristKeys();
+
+    int capacity = 1024;
+    int fieldsRead = 0;
+    int valid = 1;
+    unsigned long long key;
+    char value;
+    table->positions = (SolvedPosition *)malloc(capacity * sizeof(SolvedPosition));
+    if (table->positions == NULL) valid = 0;
+
+    while (valid && (fieldsRead = fscanf(file, "%llx %c", &key, &value)) == 2) {
+        if (table->count == capacity) {
+            SolvedPosition *grown = (SolvedPosition *)realloc(table->positions, 2 * capacity * sizeof(SolvedPosition));
+            if (grown == NULL) {
+                valid = 0;
+                break;
+            }
+            table->positions = grown;
+            capacity *= 2;
+        }
+        table->positions[table->count].key = key;
+        table->positions[table->count].value = solvedValueFromCode(value);
+        if (table->positions[table->count].value == DFPN_UNKNOWN) valid = 0;
+        table->count++;
+    }
+
+    // Anything but a clean end of file means a bad or truncated line
+    if (valid && fieldsRead != EOF) valid = 0;
+    fclose(file);
+
+    if (!valid) {
+        freeSolvedTable(table);
+        table->size = 0;
+        return 0;
+    }
+
+    qsort(table->positions, table->count, sizeof(SolvedPosition), compareSolvedPositions);
+    return 1;
+}
+
+void freeSolvedTable(SolvedTable *table) {
+    free(table->positions);
+    table->positions = NULL;
+    table->count = 0;
+}
+
+DfpnValue lookupSolvedValue(SolvedTable *table, Board *board) {
+    if (table == NULL || board->size != table->size) return DFPN_UNKNOWN;
+
+    SolvedPosition target;
+    target.key = hashBoard(board);
+    SolvedPosition *found = (SolvedPosition *)bsearch(&target, table->positions, table->count,
+                                                      sizeof(SolvedPosition), compareSolvedPositions);
+    return found == NULL ? DFPN_UNKNOWN : found->value;
+}
+
+// Picks a move that keeps a proven win, or at least avoids a proven loss; returns 0 if the table cannot tell
+int findSolvedMove(SolvedTable *table, Board *board, char marker, int *row, int *col) {
+    if (table == NULL || marker != sideToMove(board)) return 0;
+
+    // Rank 2: the opponent loses, rank 1: the opponent cannot win
+    DfpnValue value = lookupSolvedValue(table, board);
+    int requiredRank;
+    if (value == DFPN_WIN) requiredRank = 2;
+    else if (value == DFPN_DRAW || value == DFPN_NOT_LOSS) requiredRank = 1;
+    else return 0;
+
+    int bestRank = 0;
+    for (int i = 0; i < board->size; i++) {
+        for (int j = 0; j < board->size; j++) {
+            if (board->cells[i][j] != ' ') continue;
+
+            board->cells[i][j] = marker;
+            DfpnValue childValue = lookupSolvedValue(table, board);
+            board->cells[i][j] = ' ';
+
+            int rank = childValue == DFPN_LOSS ? 2 : (childValue == DFPN_DRAW || childValue == DFPN_NOT_WIN) ? 1 : 0;
+            if (rank > bestRank) {
+                bestRank = rank;
+                *row = i;
+                *col = j;
+            }
+        }
+    }
+    return bestRank >= requiredRank;
+}
+
+// Function to print the solved value of a position
+void printSolvedValue(DfpnValue value) {
+    switch (value) {
+        case DFPN_WIN:
+            printf("Proven: the side to move wins.\n");
+            break;
+        case DFPN_LOSS:
+            printf("Proven: the side to move loses.\n");
+            break;
+        case DFPN_DRAW:
+            printf("Proven: the game is a draw.\n");
+            break;
+        case DFPN_NOT_WIN:
+            printf("Proven: the side to move cannot force a win.\n");
+            break;
+        case DFPN_NOT_LOSS:
+            printf("Proven: the side to move cannot lose.\n");
+            break;
+        default:
+            printf("The value could not be proven within the node limit.\n");
+            break;
+    }
+}
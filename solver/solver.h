@@ -0,0 +1,76 @@
+#ifndef GENERALIZEDTICTACTOE_SOLVER_H
+#define GENERALIZEDTICTACTOE_SOLVER_H
+
+#include <stddef.h>
+#include <omp.h>
+
+#include "board.h"
+
+// Game value from the point of view of the side to move ('X' moves first);
+// NOT_WIN and NOT_LOSS are positions where only one of the two proofs is known
+typedef enum {
+    DFPN_UNKNOWN,
+    DFPN_WIN,
+    DFPN_LOSS,
+    DFPN_DRAW,
+    DFPN_NOT_WIN,
+    DFPN_NOT_LOSS
+} DfpnValue;
+
+// Transposition table entry; proof and disproof numbers are stored for the attacker
+typedef struct {
+    unsigned long long key;
+    unsigned int pn;
+    unsigned int dn;
+    unsigned int work;
+    unsigned int mark;
+    char attacker;
+    char toMove;
+    unsigned short busy;
+} DfpnEntry;
+
+typedef struct {
+    int size;
+    int numThreads;
+    DfpnEntry *table;
+    size_t tableBuckets;
+    omp_lock_t *locks;
+    long long nodes;
+    long long maxNodes;
+    long long progressInterval;
+    long long nextReport;
+    int stop;
+    unsigned int epoch;
+} DfpnSolver;
+
+// Proven positions loaded back from an exported file, sorted by key
+typedef struct {
+    unsigned long long key;
+    DfpnValue value;
+} SolvedPosition;
+
+typedef struct {
+    int size;
+    int count;
+    SolvedPosition *positions;
+} SolvedTable;
+
+DfpnSolver createSolver(int size, int tableMegabytes, int numThreads);
+
+void freeSolver(DfpnSolver *solver);
+
+DfpnValue solvePosition(DfpnSolver *solver, Board *board, long long maxNodes, long long progressInterval);
+
+int exportSolvedPositions(DfpnSolver *solver, const char *fileName);
+
+int loadSolvedTable(SolvedTable *table, const char *fileName);
+
+void freeSolvedTable(SolvedTable *table);
+
+DfpnValue lookupSolvedValue(SolvedTable *table, Board *board);
+
+int findSolvedMove(SolvedTable *table, Board *board, char marker, int *row, int *col);
+
+void printSolvedValue(DfpnValue value);
+
+#endif //GENERALIZEDTICTACTOE_SOLVER_H